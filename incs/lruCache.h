@@ -7,6 +7,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include "lruHot.h"
 
 #define MIN_CACHE_SIZE 5  //tamaño mínimo permitido
 
@@ -23,6 +24,7 @@ typedef struct lru_cache {
     size_t size;              // elementos actuales 
     lru_node_t *head;         // MRU (más reciente) 
     lru_node_t *tail;         // LRU (menos reciente) 
+    hot_tracker_t *hot;       // detector de claves calientes (NULL = desactivado)
 } lru_cache_t;
 
 /*
@@ -71,6 +73,26 @@ int lru_get(lru_cache_t *cache, char data);
  *   - -1 si no se encuentra o en caso de error.
  */
 int lru_search(const lru_cache_t *cache, char data);
+/*
+ * Activa el detector de claves calientes (top-K) alimentado por lru_add/lru_get.
+ * Si ya estaba activo, se reinicia con la nueva cantidad de contadores.
+ * Parámetros:
+ *   - cache: puntero al caché.
+ *   - slots: contadores a usar (1..HOT_MAX_SLOTS); 0 lo desactiva.
+ * Retorno:
+ *   - 0 en éxito, -1 en error (cache NULL, slots inválido o fallo de memoria).
+ */
+int lru_hot_enable(lru_cache_t *cache, size_t slots);
+/*
+ * Obtiene las K claves más accedidas con su conteo aproximado.
+ * Parámetros:
+ *   - cache: puntero al caché (const).
+ *   - out: arreglo de al menos k elementos.
+ *   - k: cantidad máxima de claves.
+ * Retorno:
+ *   - cantidad de entradas copiadas (0 si el detector está desactivado).
+ */
+size_t lru_top(const lru_cache_t *cache, hot_slot_t *out, size_t k);
 /* 
  *Muestra el estado actual del caché para depuración o verificación.
  * Parámetros:
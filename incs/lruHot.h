@@ -0,0 +1,71 @@
+
+//Autor: Sebastian Vera
+
+
+#ifndef LRU_HOT_H
+#define LRU_HOT_H
+
+#include <stddef.h>
+
+#define HOT_MAX_SLOTS     26      // una por letra: con 26 contadores el conteo es exacto
+#define HOT_DEFAULT_SLOTS 8       // contadores usados por defecto en el CLI/servidor
+
+// Contador monitoreado por el algoritmo Space-Saving
+typedef struct hot_slot {
+    char key;                     // letra monitoreada
+    unsigned long long count;     // accesos estimados (cota superior)
+    unsigned long long error;     // sobreestimación máxima de 'count'
+} hot_slot_t;
+
+/*
+ * Detector de claves calientes (Space-Saving, Metwally et al.).
+ * Usa una cantidad fija de contadores: si la clave ya se monitorea se
+ * incrementa su contador; si no, reemplaza al contador mínimo y hereda su
+ * valor como error. Toda clave con más de total/slots accesos aparece.
+ */
+typedef struct hot_tracker {
+    size_t slots;                 // contadores disponibles (1..HOT_MAX_SLOTS)
+    size_t used;                  // contadores ocupados
+    unsigned long long total;     // accesos registrados
+    signed char index[26];        // letra -> posición en 'slot' (-1 si no se monitorea)
+    hot_slot_t slot[HOT_MAX_SLOTS];
+} hot_tracker_t;
+
+/*
+ * Crea un detector con la cantidad de contadores indicada.
+ * Parámetros:
+ *   - slots: contadores a usar (1..HOT_MAX_SLOTS).
+ * Retorno:
+ *   - puntero al detector, o NULL si slots es inválido o malloc falla.
+ */
+hot_tracker_t *hot_create(size_t slots);
+/*
+ * Libera el detector.
+ * Parámetros:
+ *   - hot: puntero al detector (puede ser NULL).
+ * Retorno:
+ *   - Ninguno.
+ */
+void hot_destroy(hot_tracker_t *hot);
+/*
+ * Registra un acceso a una letra.
+ * Parámetros:
+ *   - hot: puntero al detector.
+ *   - key: letra mayúscula A-Z (se ignora si es inválida).
+ * Retorno:
+ *   - Ninguno.
+ */
+void hot_touch(hot_tracker_t *hot, char key);
+/*
+ * Obtiene las claves más accedidas ordenadas de mayor a menor conteo.
+ * Parámetros:
+ *   - hot: puntero al detector (const).
+ *   - out: arreglo donde se copian los contadores.
+ *   - k: cantidad máxima de entradas a copiar.
+ * Retorno:
+ *   - cantidad de entradas copiadas (<= k), 0 si hot/out es NULL.
+ */
+size_t hot_top(const hot_tracker_t *hot, hot_slot_t *out, size_t k);
+
+
+#endif
@@ -0,0 +1,67 @@
+
+//Autor: Sebastian Vera
+
+
+#ifndef LRU_SERVER_H
+#define LRU_SERVER_H
+
+#include <stddef.h>
+#include "lruCache.h"
+
+#define SERVER_LINE_MAX   128     // largo máximo de una línea de comando
+#define SERVER_INBUF_SZ   16384   // buffer de lectura por conexión
+#define SERVER_OUTBUF_SZ  32768   // buffer de respuestas por conexión
+#define SERVER_RESP_MAX   1024    // largo máximo de una línea de respuesta
+#define SERVER_MAX_EVENTS 64      // eventos procesados por epoll_wait
+#define SERVER_BACKLOG    128     // cola de conexiones pendientes
+#define SERVER_DEFAULT_CAPACITY 26 // capacidad por defecto (una por letra)
+
+/*
+ * Protocolo de texto (estilo memcached), una línea por comando terminada
+ * en "\n" o "\r\n". Cada comando produce exactamente una línea de respuesta:
+ *   add <A>     -> STORED
+ *   get <A>     -> FOUND | NOT_FOUND
+ *   search <A>  -> POS <n>          (n = -1 si no existe)
+ *   all         -> ITEMS <A> <B>... (MRU -> LRU, vacío si no hay elementos)
+ *   top <K>     -> TOP <A>:<n> ...  (K letras más accedidas, conteo aproximado;
+ *                                   CLIENT_ERROR si el detector está desactivado)
+ *   quit        -> cierra la conexión (sin respuesta)
+ * Errores: "ERROR" (comando desconocido) o "CLIENT_ERROR <motivo>".
+ * Si el cliente cierra su lado de escritura dejando un último comando sin
+ * "\n", ese comando no se ejecuta: se responde "CLIENT_ERROR incomplete line"
+ * y se cierra la conexión.
+ * Los comandos se pueden encadenar (pipelining): todas las líneas completas
+ * recibidas en una lectura se procesan y sus respuestas se envían juntas.
+ */
+
+/*
+ * Procesa un buffer con uno o más comandos y escribe las respuestas.
+ * Parámetros:
+ *   - cache: puntero al caché compartido.
+ *   - in: datos recibidos (no necesita terminar en '\0').
+ *   - in_len: cantidad de bytes en 'in'.
+ *   - out: buffer de salida para las respuestas.
+ *   - out_cap: capacidad de 'out'.
+ *   - out_len: bytes ya escritos en 'out'; se actualiza al agregar respuestas.
+ *   - quit: se pone en 1 si se recibió 'quit'.
+ * Retorno:
+ *   - cantidad de bytes de 'in' consumidos (solo líneas completas), o
+ *   - -1 si una línea supera SERVER_LINE_MAX.
+ * Se detiene antes de una línea si 'out' no tiene espacio para su respuesta.
+ */
+long server_process(lru_cache_t *cache, const char *in, size_t in_len,
+                    char *out, size_t out_cap, size_t *out_len, int *quit);
+/*
+ * Inicia el servidor y atiende clientes hasta recibir SIGINT/SIGTERM.
+ * Parámetros:
+ *   - addr: ruta de socket Unix, o número de puerto TCP (escucha en 127.0.0.1).
+ *   - capacity: capacidad del caché (>= MIN_CACHE_SIZE).
+ *   - hot_slots: contadores del detector de claves calientes
+ *                (0..HOT_MAX_SLOTS); 0 lo desactiva.
+ * Retorno:
+ *   - 0 al terminar normalmente, -1 en error de inicialización.
+ */
+int server_run(const char *addr, size_t capacity, size_t hot_slots);
+
+
+#endif
@@ -138,6 +138,7 @@ lru_cache_t *lru_create(size_t capacity) {
     cache->capacity = capacity;     // capacidad máxima 
     cache->size = 0;                // inicialmente vacío 
     cache->head = cache->tail = NULL; // lista doblemente enlazada vacía 
+    cache->hot = NULL;              // detector de claves calientes desactivado
 
     // Devolver caché listo para usar
     return cache;
@@ -158,6 +159,7 @@ void lru_destroy(lru_cache_t *cache) {
         p = sig;                   // continuar con el siguiente 
     }
 
+    hot_destroy(cache->hot); // liberar el detector (si está activo)
     free(cache); // liberar la estructura del cache
 }
 
@@ -172,6 +174,10 @@ int lru_add(lru_cache_t *cache, char data) {
     if (!cache || !lru_is_valid(data)) 
         return -1;
 
+    // Registrar el acceso en el detector de claves calientes
+    if (cache->hot)
+        hot_touch(cache->hot, data);
+
     // Si ya existe, lo usamos -> mover a MRU 
     lru_node_t *exist = node_find(cache, data);
     if (exist) {
@@ -220,6 +226,10 @@ int lru_get(lru_cache_t *cache, char data) {
     if (!cache || !lru_is_valid(data))
         return -1;
 
+    // Registrar el acceso (también los fallos cuentan como carga)
+    if (cache->hot)
+        hot_touch(cache->hot, data);
+
     //Buscar el nodo que contiene 'data' (recorre desde head).
     lru_node_t *n = node_find(cache, data);
     if (!n)
@@ -253,6 +263,41 @@ int lru_search(const lru_cache_t *cache, char data) {
 
     return -1; 
 }
+/*
+ * Activa, reinicia o desactiva (slots = 0) el detector de claves calientes.
+ * Parámetros: cache - puntero al caché
+ *             slots - contadores a usar.
+ * Retorno: 0 en éxito, -1 si cache NULL, slots inválido o malloc falla.
+ */
+int lru_hot_enable(lru_cache_t *cache, size_t slots) {
+    if (!cache)
+        return -1;
+
+    hot_tracker_t *hot = NULL;
+    if (slots > 0) {
+        hot = hot_create(slots);
+        if (!hot)
+            return -1;          // se conserva el detector anterior
+    }
+
+    hot_destroy(cache->hot);
+    cache->hot = hot;
+    return 0;
+}
+
+/*
+ * Copia las K claves más accedidas (mayor conteo primero).
+ * Parámetros: cache - puntero al caché (const)
+ *             out - arreglo destino
+ *             k - máximo de entradas.
+ * Retorno: entradas copiadas, 0 si el detector está desactivado.
+ */
+size_t lru_top(const lru_cache_t *cache, hot_slot_t *out, size_t k) {
+    if (!cache)
+        return 0;
+    return hot_top(cache->hot, out, k);
+}
+
 /*
  * Imprimir el contenido del caché en orden MRU -> LRU.
  * Parámetro: cache - puntero al caché (const).
@@ -0,0 +1,101 @@
+
+#include <stdlib.h>
+#include <string.h>
+#include "../incs/lruHot.h"
+
+
+/*
+ * Reserva un detector vacío.
+ * Parámetro: slots - contadores a usar (1..HOT_MAX_SLOTS).
+ * Retorno: puntero al detector o NULL si slots inválido o malloc falla.
+ */
+hot_tracker_t *hot_create(size_t slots) {
+    if (slots < 1 || slots > HOT_MAX_SLOTS)
+        return NULL;
+    hot_tracker_t *hot = malloc(sizeof(hot_tracker_t));
+    if (!hot)
+        return NULL;
+
+    hot->slots = slots;
+    hot->used = 0;
+    hot->total = 0;
+    memset(hot->index, -1, sizeof(hot->index)); // ninguna letra monitoreada
+    return hot;
+}
+
+/*
+ * Libera el detector.
+ * Parámetro: hot - puntero al detector (puede ser NULL).
+ */
+void hot_destroy(hot_tracker_t *hot) {
+    free(hot);
+}
+
+/*
+ * Registra un acceso a 'key' con el algoritmo Space-Saving.
+ * Parámetros: hot - puntero al detector
+ *             key - letra accedida.
+ */
+void hot_touch(hot_tracker_t *hot, char key) {
+    if (!hot || key < 'A' || key > 'Z')
+        return;
+    hot->total++;
+
+    // Caso común: la letra ya se monitorea -> solo incrementar
+    int i = hot->index[key - 'A'];
+    if (i >= 0) {
+        hot->slot[i].count++;
+        return;
+    }
+
+    // Hay contadores libres: empezar a monitorear sin error
+    if (hot->used < hot->slots) {
+        i = (int)hot->used++;
+        hot->slot[i].key = key;
+        hot->slot[i].count = 1;
+        hot->slot[i].error = 0;
+        hot->index[key - 'A'] = (signed char)i;
+        return;
+    }
+
+    // Lleno: reemplazar el contador mínimo (a lo sumo HOT_MAX_SLOTS comparaciones)
+    int min = 0;
+    for (size_t j = 1; j < hot->slots; j++)
+        if (hot->slot[j].count < hot->slot[min].count)
+            min = (int)j;
+
+    hot->index[hot->slot[min].key - 'A'] = -1;
+    hot->slot[min].key = key;
+    hot->slot[min].error = hot->slot[min].count;  // lo heredado puede no ser de 'key'
+    hot->slot[min].count++;
+    hot->index[key - 'A'] = (signed char)min;
+}
+
+/*
+ * Copia los contadores ordenados de mayor a menor (empates por letra).
+ * Parámetros: hot - puntero al detector (const)
+ *             out - arreglo destino
+ *             k - máximo de entradas.
+ * Retorno: cantidad de entradas copiadas.
+ */
+size_t hot_top(const hot_tracker_t *hot, hot_slot_t *out, size_t k) {
+    if (!hot || !out)
+        return 0;
+
+    // Ordenar una copia por inserción (a lo sumo HOT_MAX_SLOTS elementos)
+    hot_slot_t sorted[HOT_MAX_SLOTS];
+    for (size_t i = 0; i < hot->used; i++) {
+        hot_slot_t s = hot->slot[i];
+        size_t j = i;
+        while (j > 0 && (sorted[j - 1].count < s.count ||
+                         (sorted[j - 1].count == s.count && sorted[j - 1].key > s.key))) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = s;
+    }
+
+    size_t n = k < hot->used ? k : hot->used;
+    memcpy(out, sorted, n * sizeof(hot_slot_t));
+    return n;
+}
@@ -0,0 +1,611 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "../incs/lruServer.h"
+
+// Estado de una conexión de cliente (lista doblemente enlazada de conexiones)
+typedef struct server_conn {
+    int fd;
+    unsigned events;              // eventos registrados actualmente en epoll
+    int eof;                      // el cliente cerró su lado de escritura
+    int quit;                     // cerrar al terminar de enviar respuestas
+    size_t in_len;                // bytes pendientes en 'in'
+    size_t out_len;               // bytes pendientes de enviar en 'out'
+    struct server_conn *prev;
+    struct server_conn *next;
+    char in[SERVER_INBUF_SZ];
+    char out[SERVER_OUTBUF_SZ];
+} server_conn_t;
+
+// Estado del servidor
+typedef struct server {
+    int epfd;
+    int listen_fd;
+    int spare_fd;                 // descriptor de reserva para rechazar con EMFILE
+    int listen_paused;            // listen_fd fuera de epoll hasta cerrar una conexión
+    lru_cache_t *cache;
+    server_conn_t *conns;         // conexiones abiertas
+    int unix_created;             // este proceso creó el socket Unix
+    struct stat unix_st;          // identidad (dev/ino) del socket creado
+} server_t;
+
+static volatile sig_atomic_t server_stop = 0;
+
+static void on_signal(int sig) {
+    (void)sig;
+    server_stop = 1;
+}
+
+/*
+ * Agrega una línea de respuesta con formato al buffer de salida.
+ * El espacio (SERVER_RESP_MAX) ya fue verificado por el llamador.
+ */
+static void out_printf(char *out, size_t out_cap, size_t *out_len,
+                       const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(out + *out_len, out_cap - *out_len, fmt, ap);
+    va_end(ap);
+    if (n > 0)
+        *out_len += ((size_t)n < out_cap - *out_len) ? (size_t)n : out_cap - *out_len - 1;
+}
+
+/*
+ * Lee el argumento de una letra del comando actual (mismas reglas que el CLI).
+ * Retorno: letra mayúscula A-Z, o '\0' si falta o es inválido.
+ */
+static char parse_letter(void) {
+    char *arg = strtok(NULL, " \t");
+    if (!arg || strlen(arg) != 1)
+        return '\0';
+    char c = (char)toupper((unsigned char)arg[0]);
+    return lru_is_valid(c) ? c : '\0';
+}
+
+/*
+ * Ejecuta una línea de comando (ya sin salto de línea) y escribe su respuesta.
+ */
+static void exec_line(lru_cache_t *cache, char *line,
+                      char *out, size_t out_cap, size_t *out_len, int *quit) {
+    char *cmd = strtok(line, " \t");
+    if (!cmd) {
+        out_printf(out, out_cap, out_len, "ERROR\r\n");
+        return;
+    }
+
+    // add <A>
+    if (strcmp(cmd, "add") == 0) {
+        char c = parse_letter();
+        if (!c)
+            out_printf(out, out_cap, out_len, "CLIENT_ERROR usage: add <A>\r\n");
+        else if (lru_add(cache, c) == 0)
+            out_printf(out, out_cap, out_len, "STORED\r\n");
+        else
+            out_printf(out, out_cap, out_len, "SERVER_ERROR out of memory\r\n");
+        return;
+    }
+
+    // get <A>
+    if (strcmp(cmd, "get") == 0) {
+        char c = parse_letter();
+        if (!c)
+            out_printf(out, out_cap, out_len, "CLIENT_ERROR usage: get <A>\r\n");
+        else
+            out_printf(out, out_cap, out_len,
+                       lru_get(cache, c) == 0 ? "FOUND\r\n" : "NOT_FOUND\r\n");
+        return;
+    }
+
+    // search <A>
+    if (strcmp(cmd, "search") == 0) {
+        char c = parse_letter();
+        if (!c)
+            out_printf(out, out_cap, out_len, "CLIENT_ERROR usage: search <A>\r\n");
+        else
+            out_printf(out, out_cap, out_len, "POS %d\r\n", lru_search(cache, c));
+        return;
+    }
+
+    // all: recorrer MRU -> LRU sin modificar prioridades
+    if (strcmp(cmd, "all") == 0) {
+        out_printf(out, out_cap, out_len, "ITEMS");
+        for (lru_node_t *p = cache->head; p; p = p->next)
+            out_printf(out, out_cap, out_len, " %c", p->data);
+        out_printf(out, out_cap, out_len, "\r\n");
+        return;
+    }
+
+    // top <K>: claves más accedidas según el detector
+    if (strcmp(cmd, "top") == 0) {
+        char *arg = strtok(NULL, " \t");
+        long k = arg ? strtol(arg, NULL, 10) : 0;
+        if (k < 1) {
+            out_printf(out, out_cap, out_len, "CLIENT_ERROR usage: top <K>\r\n");
+            return;
+        }
+        if (!cache->hot) {
+            out_printf(out, out_cap, out_len, "CLIENT_ERROR hot-key tracker disabled\r\n");
+            return;
+        }
+        hot_slot_t top[HOT_MAX_SLOTS];
+        size_t cnt = lru_top(cache, top, k < HOT_MAX_SLOTS ? (size_t)k : HOT_MAX_SLOTS);
+        out_printf(out, out_cap, out_len, "TOP");
+        for (size_t i = 0; i < cnt; i++)
+            out_printf(out, out_cap, out_len, " %c:%llu", top[i].key, top[i].count);
+        out_printf(out, out_cap, out_len, "\r\n");
+        return;
+    }
+
+    // quit: cerrar la conexión tras enviar lo pendiente
+    if (strcmp(cmd, "quit") == 0) {
+        *quit = 1;
+        return;
+    }
+
+    out_printf(out, out_cap, out_len, "ERROR\r\n");
+}
+
+/*
+ * Procesa todas las líneas completas de 'in' (ver lruServer.h).
+ */
+long server_process(lru_cache_t *cache, const char *in, size_t in_len,
+                    char *out, size_t out_cap, size_t *out_len, int *quit) {
+    if (!cache || !in || !out || !out_len || !quit)
+        return -1;
+
+    size_t pos = 0;
+    while (pos < in_len && !*quit) {
+        // Solo líneas completas; una línea parcial espera más datos
+        const char *nl = memchr(in + pos, '\n', in_len - pos);
+        size_t len = nl ? (size_t)(nl - (in + pos)) : in_len - pos;
+        if (len > SERVER_LINE_MAX)
+            return -1;                  // línea demasiado larga
+        if (!nl)
+            break;
+
+        // Sin espacio para otra respuesta: el llamador debe enviar primero
+        if (out_cap - *out_len < SERVER_RESP_MAX)
+            break;
+
+        char line[SERVER_LINE_MAX + 1];
+        memcpy(line, in + pos, len);
+        line[len] = '\0';
+        line[strcspn(line, "\r")] = '\0';
+
+        exec_line(cache, line, out, out_cap, out_len, quit);
+        pos += len + 1;
+    }
+    return (long)pos;
+}
+
+/*
+ * Configura un descriptor como no bloqueante.
+ * Retorno: 0 en éxito, -1 en error.
+ */
+static int set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0)
+        return -1;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/*
+ * Indica si 'addr' es un número de puerto TCP (solo dígitos).
+ */
+static int is_port(const char *addr) {
+    if (!*addr)
+        return 0;
+    for (const char *p = addr; *p; p++)
+        if (!isdigit((unsigned char)*p))
+            return 0;
+    return 1;
+}
+
+/*
+ * Crea el socket de escucha: puerto TCP en 127.0.0.1 si 'addr' es numérico,
+ * o socket Unix en la ruta 'addr' en otro caso. Solo reemplaza un socket
+ * previo; si la ruta existe y es otro tipo de archivo, falla sin tocarlo.
+ * Parámetros: addr - ruta o puerto
+ *             created - se llena con el stat del socket Unix creado
+ *                       (st_ino = 0 si no se creó ninguno).
+ * Retorno: descriptor en escucha, o -1 en error (ya informado por stderr).
+ */
+static int listen_on(const char *addr, struct stat *created) {
+    int fd;
+    created->st_ino = 0;
+
+    if (is_port(addr)) {
+        long port = strtol(addr, NULL, 10);
+        if (port <= 0 || port > 65535) {
+            fprintf(stderr, "Error: puerto inválido %s\n", addr);
+            return -1;
+        }
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            perror("socket");
+            return -1;
+        }
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        struct sockaddr_in sin;
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons((unsigned short)port);
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, (struct sockaddr *)&sin, sizeof(sin)) < 0) {
+            perror("bind");
+            close(fd);
+            return -1;
+        }
+    } else {
+        struct sockaddr_un sa_un;
+        if (strlen(addr) >= sizeof(sa_un.sun_path)) {
+            fprintf(stderr, "Error: ruta de socket demasiado larga\n");
+            return -1;
+        }
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            perror("socket");
+            return -1;
+        }
+
+        // Eliminar solo un socket de una ejecución previa, nunca otro archivo
+        struct stat st;
+        if (lstat(addr, &st) == 0) {
+            if (!S_ISSOCK(st.st_mode)) {
+                fprintf(stderr, "Error: %s existe y no es un socket\n", addr);
+                close(fd);
+                return -1;
+            }
+            unlink(addr);
+        }
+
+        memset(&sa_un, 0, sizeof(sa_un));
+        sa_un.sun_family = AF_UNIX;
+        strcpy(sa_un.sun_path, addr);
+        if (bind(fd, (struct sockaddr *)&sa_un, sizeof(sa_un)) < 0) {
+            perror("bind");
+            close(fd);
+            return -1;
+        }
+        // Recordar el socket creado para borrarlo solo a él al terminar
+        if (lstat(addr, created) < 0)
+            created->st_ino = 0;
+    }
+
+    if (listen(fd, SERVER_BACKLOG) < 0 || set_nonblocking(fd) < 0) {
+        perror("listen");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*
+ * Cambia los eventos registrados para una conexión (solo si difieren).
+ * Retorno: 0 en éxito, -1 en error.
+ */
+static int conn_watch(server_t *srv, server_conn_t *c, unsigned events) {
+    if (c->events == events)
+        return 0;
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = c;
+    if (epoll_ctl(srv->epfd, EPOLL_CTL_MOD, c->fd, &ev) < 0)
+        return -1;
+    c->events = events;
+    return 0;
+}
+
+/*
+ * Envía lo pendiente en el buffer de salida.
+ * Retorno: 0 si se envió todo o el socket está lleno, -1 en error.
+ */
+static int conn_flush(server_conn_t *c) {
+    size_t off = 0;
+    while (off < c->out_len) {
+        ssize_t w = write(c->fd, c->out + off, c->out_len - off);
+        if (w > 0) {
+            off += (size_t)w;
+        } else if (w < 0 && errno == EINTR) {
+            continue;
+        } else if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            return -1;
+        }
+    }
+    // Conservar al inicio del buffer lo que no se pudo enviar
+    memmove(c->out, c->out + off, c->out_len - off);
+    c->out_len -= off;
+    return 0;
+}
+
+/*
+ * Atiende una conexión lista: envía lo pendiente, hace una sola lectura,
+ * procesa los comandos completos y responde con una sola escritura por lote.
+ * epoll (por nivel) vuelve a avisar si quedan datos, así ningún cliente que
+ * encadena comandos sin parar acapara el bucle de eventos.
+ * Retorno: 0 si la conexión sigue abierta, -1 si debe cerrarse.
+ */
+static int conn_handle(server_t *srv, server_conn_t *c) {
+    if (conn_flush(c) < 0)
+        return -1;
+    // Socket lleno: dejar de leer hasta poder enviar (contrapresión)
+    if (c->out_len > 0)
+        return conn_watch(srv, c, EPOLLOUT);
+    if (c->quit)
+        return -1;
+
+    // Una lectura por evento, de hasta lo que quepa en el buffer de entrada
+    if (!c->eof && c->in_len < SERVER_INBUF_SZ) {
+        ssize_t r = read(c->fd, c->in + c->in_len, SERVER_INBUF_SZ - c->in_len);
+        if (r > 0)
+            c->in_len += (size_t)r;
+        else if (r == 0)
+            c->eof = 1;
+        else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+            return -1;
+    }
+
+    // Procesar lo recibido; si se llena la salida, enviar y continuar solo
+    // con lo ya leído (sin volver a leer)
+    for (;;) {
+        long used = server_process(srv->cache, c->in, c->in_len,
+                                   c->out, sizeof(c->out), &c->out_len, &c->quit);
+        if (used < 0) {
+            // Línea demasiado larga: informar y cerrar
+            if (sizeof(c->out) - c->out_len >= SERVER_RESP_MAX)
+                out_printf(c->out, sizeof(c->out), &c->out_len,
+                           "CLIENT_ERROR line too long\r\n");
+            c->quit = 1;
+            c->in_len = 0;
+        } else {
+            memmove(c->in, c->in + used, c->in_len - (size_t)used);
+            c->in_len -= (size_t)used;
+        }
+
+        if (conn_flush(c) < 0)
+            return -1;
+        if (c->out_len > 0)
+            return conn_watch(srv, c, EPOLLOUT);
+        if (c->quit)
+            return -1;
+        if (!memchr(c->in, '\n', c->in_len))
+            break;
+    }
+
+    // Sin líneas completas pendientes: cerrar si el cliente terminó
+    if (c->eof) {
+        // Un último comando sin '\n' no se ejecuta, pero recibe respuesta
+        if (c->in_len > 0) {
+            out_printf(c->out, sizeof(c->out), &c->out_len,
+                       "CLIENT_ERROR incomplete line\r\n");
+            c->in_len = 0;
+            c->quit = 1;
+            if (conn_flush(c) < 0)
+                return -1;
+            if (c->out_len > 0)
+                return conn_watch(srv, c, EPOLLOUT);
+        }
+        return -1;
+    }
+    return conn_watch(srv, c, EPOLLIN);
+}
+
+/*
+ * Cierra una conexión y la quita de la lista del servidor.
+ */
+static void conn_close(server_t *srv, server_conn_t *c) {
+    if (c->prev)
+        c->prev->next = c->next;
+    else
+        srv->conns = c->next;
+    if (c->next)
+        c->next->prev = c->prev;
+    close(c->fd);                       // también la elimina de epoll
+    free(c);
+
+    // Se liberó un descriptor: volver a aceptar si estaba en pausa
+    if (srv->listen_paused) {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = NULL;
+        if (epoll_ctl(srv->epfd, EPOLL_CTL_ADD, srv->listen_fd, &ev) == 0)
+            srv->listen_paused = 0;
+    }
+}
+
+/*
+ * Sin descriptores libres (EMFILE/ENFILE): la conexión pendiente mantiene
+ * listen_fd listo y epoll (por nivel) despertaría sin parar. Se usa el
+ * descriptor de reserva para aceptarla y cerrarla de inmediato; si no hay
+ * reserva, se deja de vigilar listen_fd hasta que se cierre una conexión.
+ * Retorno: 1 si se descartó una conexión (puede haber más), 0 si no quedan
+ *          pendientes o se pausó.
+ */
+static int accept_exhausted(server_t *srv) {
+    if (srv->spare_fd >= 0) {
+        close(srv->spare_fd);
+        int fd = accept(srv->listen_fd, NULL, NULL);
+        int err = errno;
+        if (fd >= 0)
+            close(fd);                  // liberar antes de recuperar la reserva
+        srv->spare_fd = open("/dev/null", O_RDONLY);
+        if (fd >= 0) {
+            fprintf(stderr, "accept: sin descriptores libres, conexión rechazada\n");
+            return 1;
+        }
+        if (err == EAGAIN || err == EWOULDBLOCK)
+            return 0;                   // no quedaban conexiones pendientes
+    }
+
+    if (epoll_ctl(srv->epfd, EPOLL_CTL_DEL, srv->listen_fd, NULL) == 0)
+        srv->listen_paused = 1;
+    fprintf(stderr, "accept: sin descriptores libres, pausando nuevas conexiones\n");
+    return 0;
+}
+
+/*
+ * Acepta todas las conexiones pendientes y las registra en epoll.
+ */
+static void accept_all(server_t *srv) {
+    for (;;) {
+        int fd = accept(srv->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EMFILE || errno == ENFILE) {
+                if (accept_exhausted(srv))
+                    continue;
+                return;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                perror("accept");
+            return;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // falla en Unix: se ignora
+
+        server_conn_t *c = malloc(sizeof(server_conn_t));
+        if (!c || set_nonblocking(fd) < 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        c->events = EPOLLIN;
+        c->eof = c->quit = 0;
+        c->in_len = c->out_len = 0;
+
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = c;
+        if (epoll_ctl(srv->epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+
+        // Insertar al frente de la lista de conexiones
+        c->prev = NULL;
+        c->next = srv->conns;
+        if (srv->conns)
+            srv->conns->prev = c;
+        srv->conns = c;
+    }
+}
+
+/*
+ * Bucle de eventos del servidor (ver lruServer.h).
+ */
+int server_run(const char *addr, size_t capacity, size_t hot_slots) {
+    if (!addr)
+        return -1;
+
+    server_t srv;
+    srv.conns = NULL;
+    srv.listen_paused = 0;
+    srv.cache = lru_create(capacity);
+    if (!srv.cache) {
+        fprintf(stderr, "Error: capacidad inválida (>= %d)\n", MIN_CACHE_SIZE);
+        return -1;
+    }
+    if (hot_slots > HOT_MAX_SLOTS) {
+        fprintf(stderr, "Error: los contadores deben estar entre 0 y %d\n", HOT_MAX_SLOTS);
+        lru_destroy(srv.cache);
+        return -1;
+    }
+    if (lru_hot_enable(srv.cache, hot_slots) != 0) {
+        fprintf(stderr, "Error: no se pudo crear el detector de claves calientes (malloc fallo).\n");
+        lru_destroy(srv.cache);
+        return -1;
+    }
+
+    srv.listen_fd = listen_on(addr, &srv.unix_st);
+    srv.unix_created = srv.unix_st.st_ino != 0;
+    if (srv.listen_fd < 0) {
+        lru_destroy(srv.cache);
+        return -1;
+    }
+
+    srv.spare_fd = open("/dev/null", O_RDONLY);
+    srv.epfd = epoll_create1(0);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;                 // NULL identifica al socket de escucha
+    if (srv.epfd < 0 || epoll_ctl(srv.epfd, EPOLL_CTL_ADD, srv.listen_fd, &ev) < 0) {
+        perror("epoll");
+        if (srv.epfd >= 0)
+            close(srv.epfd);
+        if (srv.spare_fd >= 0)
+            close(srv.spare_fd);
+        close(srv.listen_fd);
+        lru_destroy(srv.cache);
+        return -1;
+    }
+
+    // SIGINT/SIGTERM terminan el bucle; SIGPIPE se ignora (errores vía write)
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, NULL);
+
+    printf("Servidor escuchando en %s (capacidad %zu, contadores %zu)\n",
+           addr, capacity, hot_slots);
+    fflush(stdout);
+
+    struct epoll_event events[SERVER_MAX_EVENTS];
+    while (!server_stop) {
+        int n = epoll_wait(srv.epfd, events, SERVER_MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            server_conn_t *c = events[i].data.ptr;
+            if (!c) {
+                accept_all(&srv);
+                continue;
+            }
+            if (conn_handle(&srv, c) < 0)
+                conn_close(&srv, c);
+        }
+    }
+
+    // Liberar conexiones abiertas, sockets y caché
+    while (srv.conns)
+        conn_close(&srv, srv.conns);
+    close(srv.epfd);
+    close(srv.listen_fd);
+    if (srv.spare_fd >= 0)
+        close(srv.spare_fd);
+    // Borrar el socket Unix solo si sigue siendo el que creó este proceso
+    struct stat st;
+    if (srv.unix_created && lstat(addr, &st) == 0 && S_ISSOCK(st.st_mode) &&
+        st.st_dev == srv.unix_st.st_dev && st.st_ino == srv.unix_st.st_ino)
+        unlink(addr);
+    lru_destroy(srv.cache);
+    return 0;
+}
@@ -3,19 +3,22 @@
 #include <string.h>
 #include <ctype.h>
 #include "../incs/lruCache.h"
+#include "../incs/lruServer.h"
 
 #define LINE_SZ 128
 
 // Muestra un menú breve con los comandos y su uso.
 static void print_menu() {
     puts("Comandos disponibles:");
-    puts("  create <N>    - Crear/reescribir caché con capacidad N (N >= 5)");
-    puts("  add <A>       - Añadir o usar letra mayúscula A");
-    puts("  get <A>       - Promover letra A a MRU si existe");
-    puts("  search <A>    - Imprimir índice de A (0 = MRU) o -1 si no existe");
-    puts("  all           - Mostrar contenido (MRU -> LRU)");
-    puts("  tutorial      - Mostrar ejemplo de uso");
-    puts("  exit          - Salir");
+    puts("  create <N> [M] - Crear/reescribir caché con capacidad N (N >= 5)");
+    puts("                   y M contadores de claves calientes (0 = sin detector)");
+    puts("  add <A>        - Añadir o usar letra mayúscula A");
+    puts("  get <A>        - Promover letra A a MRU si existe");
+    puts("  search <A>     - Imprimir índice de A (0 = MRU) o -1 si no existe");
+    puts("  all            - Mostrar contenido (MRU -> LRU)");
+    puts("  top <K>        - Mostrar las K letras más accedidas (conteo aproximado)");
+    puts("  tutorial       - Mostrar ejemplo de uso");
+    puts("  exit           - Salir");
 }
 
 // Imprime un tutorial paso a paso 
@@ -56,12 +59,53 @@ static void print_tutorial() {
     puts("   Comando:  all");
     puts("   Descripción: imprime el contenido en orden MRU -> LRU.");
     puts("");
-    puts("7) Salir:");
+    puts("7) Claves más accedidas:");
+    puts("   Comando:  top 3");
+    puts("   Descripción: muestra las 3 letras con más add/get y su conteo aproximado.");
+    puts("");
+    puts("8) Salir:");
     puts("   Comando:  exit");
     puts("");
 }
 
-int main() {
+// Modo servidor: lru serve <socket|puerto> [N] [M]
+static int run_server(int argc, char *argv[]) {
+    long n = SERVER_DEFAULT_CAPACITY;
+    if (argc >= 4)
+        n = strtol(argv[3], NULL, 10);
+
+    if (n < MIN_CACHE_SIZE) {
+        printf("Error: el tamaño debe ser >= %d\n", MIN_CACHE_SIZE);
+        return 1;
+    }
+
+    // Contadores del detector de claves calientes (0 = sin detector)
+    long m = HOT_DEFAULT_SLOTS;
+    if (argc >= 5) {
+        char *end = NULL;
+        m = strtol(argv[4], &end, 10);
+        if (end == argv[4] || *end != '\0')
+            m = -1;                     // rechazar M no numérico
+    }
+
+    if (m < 0 || m > HOT_MAX_SLOTS) {
+        printf("Error: los contadores deben estar entre 0 y %d\n", HOT_MAX_SLOTS);
+        return 1;
+    }
+    return server_run(argv[2], (size_t)n, (size_t)m) == 0 ? 0 : 1;
+}
+
+int main(int argc, char *argv[]) {
+    // Si se invoca como 'lru serve <socket|puerto> [N] [M]' atiende clientes por socket
+    // en lugar de leer comandos desde stdin.
+    if (argc >= 2 && strcmp(argv[1], "serve") == 0) {
+        if (argc < 3) {
+            puts("Uso: lru serve <ruta_socket|puerto> [N] [M]");
+            return 1;
+        }
+        return run_server(argc, argv);
+    }
+
     // Declara un buffer para leer cada línea de entrada del usuario.
     char line[LINE_SZ]; 
     // Puntero al caché
@@ -120,9 +164,21 @@ int main() {
                 continue;
             }
 
+            // Cantidad opcional de contadores del detector de claves calientes
+            char *arg_m = strtok(NULL, " \t");
+            char *end = NULL;
+            long m = arg_m ? strtol(arg_m, &end, 10) : HOT_DEFAULT_SLOTS;
+
+            if ((arg_m && (end == arg_m || *end != '\0')) || m < 0 || m > HOT_MAX_SLOTS) {
+            // Rechaza M no numérico (p. ej. "x", que strtol convertiría en 0) o fuera de rango
+                printf("Error: los contadores deben estar entre 0 y %d\n", HOT_MAX_SLOTS);
+                continue;
+            }
+
             // Crear primero y comprobar exito antes de destruir el anterior
             lru_cache_t *new_cache = lru_create((size_t)n);
-            if (!new_cache) {
+            if (!new_cache || lru_hot_enable(new_cache, (size_t)m) != 0) {
+                lru_destroy(new_cache);
                 puts("Error: no se pudo crear el caché (malloc fallo).");
                 continue;
             }
@@ -252,6 +308,35 @@ int main() {
             continue;
         }
 
+        // top <K>
+        // Maneja el comando: top <K>. Imprime las K letras más accedidas.
+        if (strcmp(cmd, "top") == 0) {
+            char *arg = strtok(NULL, " \t");
+            // Toma el siguiente token (el argumento K).
+
+            long k = arg ? strtol(arg, NULL, 10) : 0;
+            if (k < 1 || !cache) {
+            // Si falta K, no es positivo o no hay caché, se ignora el comando.
+                puts("Uso: top <K>  (K >= 1)");
+                continue;
+            }
+
+            if (!cache->hot) {
+            // El caché se creó sin detector (create <N> 0)
+                puts("Detector desactivado: usar 'create <N> <M>' con M > 0");
+                continue;
+            }
+
+            // Obtener los contadores ordenados e imprimir uno por línea
+            hot_slot_t top[HOT_MAX_SLOTS];
+            size_t cnt = lru_top(cache, top, k < HOT_MAX_SLOTS ? (size_t)k : HOT_MAX_SLOTS);
+            for (size_t i = 0; i < cnt; i++)
+                printf("%c %llu (error <= %llu)\n", top[i].key, top[i].count, top[i].error);
+            if (cnt == 0)
+                puts("(sin accesos)");
+            continue;
+        }
+
         // exit 
         // Maneja el comando: exit. Sale del bucle principal para terminar el programa.
         if (strcmp(cmd, "exit") == 0) {
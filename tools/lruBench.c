@@ -0,0 +1,261 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+/*
+ * Generador de carga para 'lru serve'.
+ * Abre C conexiones, envía lotes de P comandos (pipelining) por conexión y
+ * mide el tiempo de ida y vuelta de cada lote hasta completar N comandos.
+ * Uso: lru_bench [-c conexiones] [-n comandos] [-p lote] [-r %get] <ruta_socket|puerto>
+ */
+
+#define BENCH_CMD_SZ  8       // "add A\r\n" / "get A\r\n" = 7 bytes
+#define BENCH_RBUF_SZ 65536
+#define BENCH_MAX_BATCH 4096  // evita bloquear escrituras con el servidor lleno
+
+// Estado de una conexión del generador
+typedef struct bench_conn {
+    int fd;
+    size_t pending;           // respuestas que faltan del lote actual
+    size_t wlen;              // bytes del lote por enviar
+    size_t woff;              // bytes del lote ya enviados
+    double t0;                // instante en que se envió el lote
+    char *wbuf;               // comandos del lote actual
+} bench_conn_t;
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// xorshift32: generador barato para elegir comando y letra
+static unsigned rng_next(unsigned *s) {
+    unsigned x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Conecta al servidor: puerto TCP en 127.0.0.1 si 'addr' es numérico,
+ * o socket Unix en otro caso.
+ * Retorno: descriptor conectado, o -1 en error.
+ */
+static int connect_to(const char *addr) {
+    int numeric = *addr != '\0';
+    for (const char *p = addr; *p; p++)
+        if (!isdigit((unsigned char)*p))
+            numeric = 0;
+
+    int fd;
+    if (numeric) {
+        struct sockaddr_in sin;
+        memset(&sin, 0, sizeof(sin));
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons((unsigned short)strtol(addr, NULL, 10));
+        sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0 || connect(fd, (struct sockaddr *)&sin, sizeof(sin)) < 0)
+            goto fail;
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    } else {
+        struct sockaddr_un sa_un;
+        if (strlen(addr) >= sizeof(sa_un.sun_path))
+            return -1;
+        memset(&sa_un, 0, sizeof(sa_un));
+        sa_un.sun_family = AF_UNIX;
+        strcpy(sa_un.sun_path, addr);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || connect(fd, (struct sockaddr *)&sa_un, sizeof(sa_un)) < 0)
+            goto fail;
+    }
+    return fd;
+
+fail:
+    if (fd >= 0)
+        close(fd);
+    return -1;
+}
+
+/*
+ * Arma un nuevo lote de 'batch' comandos add/get con letras aleatorias.
+ */
+static void fill_batch(bench_conn_t *c, size_t batch, int get_pct, unsigned *seed) {
+    char *w = c->wbuf;
+    for (size_t i = 0; i < batch; i++) {
+        int is_get = (int)(rng_next(seed) % 100) < get_pct;
+        char letter = (char)('A' + rng_next(seed) % 26);
+        w += sprintf(w, "%s %c\r\n", is_get ? "get" : "add", letter);
+    }
+    c->wlen = (size_t)(w - c->wbuf);
+    c->woff = 0;
+    c->pending = batch;
+}
+
+/*
+ * Envía lo que quede del lote actual.
+ * Retorno: 0 en éxito (puede quedar pendiente), -1 en error.
+ */
+static int send_batch(bench_conn_t *c) {
+    while (c->woff < c->wlen) {
+        ssize_t w = write(c->fd, c->wbuf + c->woff, c->wlen - c->woff);
+        if (w < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        c->woff += (size_t)w;
+    }
+    return 0;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Uso: %s [-c conexiones] [-n comandos] [-p lote] [-r %%get] "
+                    "<ruta_socket|puerto>\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    long conns = 4, total = 1000000, batch = 32, get_pct = 80;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:n:p:r:")) != -1) {
+        switch (opt) {
+        case 'c': conns = strtol(optarg, NULL, 10); break;
+        case 'n': total = strtol(optarg, NULL, 10); break;
+        case 'p': batch = strtol(optarg, NULL, 10); break;
+        case 'r': get_pct = strtol(optarg, NULL, 10); break;
+        default: usage(argv[0]); return 1;
+        }
+    }
+    if (optind >= argc || conns < 1 || total < 1 || batch < 1 || batch > BENCH_MAX_BATCH ||
+        get_pct < 0 || get_pct > 100) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char *addr = argv[optind];
+
+    // Cada lote completo aporta una muestra de latencia
+    size_t max_samples = (size_t)(total / batch + conns + 1);
+    double *lat = malloc(max_samples * sizeof(double));
+    bench_conn_t *cs = calloc((size_t)conns, sizeof(bench_conn_t));
+    char *rbuf = malloc(BENCH_RBUF_SZ);
+    int epfd = epoll_create1(0);
+    if (!lat || !cs || !rbuf || epfd < 0) {
+        perror("init");
+        return 1;
+    }
+
+    unsigned seed = 2463534242u;
+    long sent = 0, done = 0;
+    size_t nsamples = 0;
+
+    double start = now_us();
+    for (long i = 0; i < conns; i++) {
+        bench_conn_t *c = &cs[i];
+        c->fd = connect_to(addr);
+        c->wbuf = malloc((size_t)batch * BENCH_CMD_SZ);
+        if (c->fd < 0 || !c->wbuf) {
+            perror("connect");
+            return 1;
+        }
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = c;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, c->fd, &ev);
+
+        // Primer lote de cada conexión
+        size_t n = (size_t)(total - sent < batch ? total - sent : batch);
+        if (n == 0)
+            continue;
+        fill_batch(c, n, (int)get_pct, &seed);
+        sent += (long)n;
+        c->t0 = now_us();
+        if (send_batch(c) < 0) {
+            perror("write");
+            return 1;
+        }
+    }
+
+    // Bucle: leer respuestas, medir el lote y enviar el siguiente
+    struct epoll_event events[64];
+    while (done < total) {
+        int n = epoll_wait(epfd, events, 64, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            return 1;
+        }
+        for (int i = 0; i < n; i++) {
+            bench_conn_t *c = events[i].data.ptr;
+            ssize_t r = read(c->fd, rbuf, BENCH_RBUF_SZ);
+            if (r <= 0) {
+                if (r < 0 && errno == EINTR)
+                    continue;
+                fprintf(stderr, "Conexión cerrada por el servidor\n");
+                return 1;
+            }
+            // Cada respuesta es exactamente una línea
+            for (ssize_t k = 0; k < r; k++) {
+                if (rbuf[k] != '\n')
+                    continue;
+                c->pending--;
+                done++;
+            }
+            if (c->pending > 0)
+                continue;
+
+            lat[nsamples++] = now_us() - c->t0;
+            size_t next = (size_t)(total - sent < batch ? total - sent : batch);
+            if (next == 0)
+                continue;
+            fill_batch(c, next, (int)get_pct, &seed);
+            sent += (long)next;
+            c->t0 = now_us();
+            if (send_batch(c) < 0) {
+                perror("write");
+                return 1;
+            }
+        }
+    }
+    double elapsed = now_us() - start;
+
+    qsort(lat, nsamples, sizeof(double), cmp_double);
+    printf("conexiones: %ld  lote: %ld  comandos: %ld  get: %ld%%\n",
+           conns, batch, total, get_pct);
+    printf("tiempo:     %.3f s\n", elapsed / 1e6);
+    printf("req/s:      %.0f\n", total / (elapsed / 1e6));
+    printf("latencia por lote (us): p50 %.1f  p90 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+           lat[nsamples * 50 / 100], lat[nsamples * 90 / 100],
+           lat[nsamples * 99 / 100], lat[nsamples * 999 / 1000], lat[nsamples - 1]);
+
+    for (long i = 0; i < conns; i++) {
+        close(cs[i].fd);
+        free(cs[i].wbuf);
+    }
+    close(epfd);
+    free(cs);
+    free(rbuf);
+    free(lat);
+    return 0;
+}